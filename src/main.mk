@@ -79,6 +79,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
+                overlapInCore/liboverlap/prefixEditDistance-extendEdlib.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
                 \
@@ -161,6 +162,8 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/gatekeeperDumpFASTQ.mk \
                 stores/gatekeeperDumpMetaData.mk \
                 stores/gatekeeperPartition.mk \
+                stores/gatekeeperRepack.mk \
+                stores/gatekeeperShare.mk \
                 stores/ovStoreBuild.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
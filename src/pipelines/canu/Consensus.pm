@@ -170,6 +170,7 @@ sub partitionReads ($$) {
     $cmd .= "  -T ./$asm.${tag}Store 1 \\\n";
     $cmd .= "  -b " . getGlobal("cnsPartitionMin") . " \\\n"   if (defined(getGlobal("cnsPartitionMin")));
     $cmd .= "  -p " . getGlobal("cnsPartitions")   . " \\\n"   if (defined(getGlobal("cnsPartitions")));
+    $cmd .= "  -compress \\\n"                                 if (getGlobal("cnsPartitionCompress") == 1);
     $cmd .= "> ./$asm.${tag}Store/partitionedReads.log 2>&1";
 
     if (runCommand("unitigging", $cmd)) {
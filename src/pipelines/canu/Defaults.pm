@@ -629,7 +629,7 @@ sub setOverlapDefaults ($$$) {
     $synops{"${tag}OvlRefBlockLength"}        = "Amount of sequence (bp) to search against the hash table per batch";
 
     $global{"${tag}OvlHashBits"}              = ($tag eq "cor") ? 18 : 23;
-    $synops{"${tag}OvlHashBits"}              = "Width of the kmer hash.  Width 22=1gb, 23=2gb, 24=4gb, 25=8gb.  Plus 10b per ${tag}OvlHashBlockLength";
+    $synops{"${tag}OvlHashBits"}              = "Width of the kmer hash.  Width 22=1gb, 23=2gb, 24=4gb, 25=8gb.  Plus 10b per ${tag}OvlHashBlockLength, and up to 64mb more to build the hash with multiple threads";
 
     $global{"${tag}OvlHashLoad"}              = 0.75;
     $synops{"${tag}OvlHashLoad"}              = "Maximum hash table load.  If set too high, table lookups are inefficent; if too low, search overhead dominates run time; default 0.75";
@@ -890,6 +890,11 @@ sub setDefaults () {
     $global{"objectStoreNameSpace"}        = undef;
     $synops{"objectStoreNameSpace"}        = "Object store parameters; specific to the type of objectStore used";
 
+    #####  Gatekeeper
+
+    $global{"gkpThreads"}                  = 1;
+    $synops{"gkpThreads"}                  = "Number of threads to use when loading reads into the gkpStore; runs in the canu process; default 1";
+
     #####  Overlapper
 
     setOverlapDefaults("cor", "correction",             "mhap");  #  Overlaps computed for correction
@@ -899,7 +904,7 @@ sub setDefaults () {
     ##### Overlap Store
 
     $global{"ovsMethod"}                   = undef;
-    $synops{"ovsMethod"}                   = "Use the 'sequential' or 'parallel' algorithm for constructing an overlap store; default 'sequential'";
+    $synops{"ovsMethod"}                   = "Use the 'sequential', 'stream' or 'parallel' algorithm for constructing an overlap store; default 'sequential'";
 
     #####  Mers
 
@@ -976,6 +981,9 @@ sub setDefaults () {
     $global{"cnsPartitionMin"}             = undef;
     $synops{"cnsPartitionMin"}             = "Don't make a consensus partition with fewer than N reads";
 
+    $global{"cnsPartitionCompress"}        = 0;
+    $synops{"cnsPartitionCompress"}        = "Compress the reads in each consensus partition; smaller on disk, decompressed into memory by each job";
+
     $global{"cnsMaxCoverage"}              = 40;
     $synops{"cnsMaxCoverage"}              = "Limit unitig consensus to at most this coverage; default '0' = unlimited";
 
@@ -1394,6 +1402,13 @@ sub checkParameters () {
         addCommandLineError("ERROR:  Invalid 'corFilter' specified (" . getGlobal("corFilter") . "); must be 'none' or 'quick' or 'expensive'\n");
     }
 
+    if ((defined(getGlobal("ovsMethod"))) &&
+        (getGlobal("ovsMethod") ne "sequential") &&
+        (getGlobal("ovsMethod") ne "stream") &&
+        (getGlobal("ovsMethod") ne "parallel")) {
+        addCommandLineError("ERROR:  Invalid 'ovsMethod' specified (" . getGlobal("ovsMethod") . "); must be 'sequential', 'stream' or 'parallel'\n");
+    }
+
 
     if ((getGlobal("useGrid") ne "0") &&
         (getGlobal("useGrid") ne "1") &&
@@ -685,9 +685,10 @@ sub submitScript ($$) {
     my $mem = 4;
     my $thr = 1;
 
-    #  However, the sequential overlap store is still built from within the canu process.
+    #  However, the sequential (and streaming) overlap store is still built from within the canu process.
 
-    if (getGlobal("ovsMethod") eq "sequential") {
+    if ((getGlobal("ovsMethod") eq "sequential") ||
+        (getGlobal("ovsMethod") eq "stream")) {
         $mem = getGlobal("ovsMemory");
         $mem = $2  if ($mem =~ m/^(\d+)-(\d+)$/);
     }
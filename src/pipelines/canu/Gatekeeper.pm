@@ -248,6 +248,7 @@ sub gatekeeperCreateStore ($$@) {
     my $cmd;
     $cmd .= "$bin/gatekeeperCreate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -t " . getGlobal("gkpThreads") . " \\\n";
     $cmd .= "  -o ./$asm.gkpStore.BUILDING \\\n";
     $cmd .= "  ./$asm.gkpStore.gkp \\\n";
     $cmd .= "> ./$asm.gkpStore.BUILDING.err 2>&1";
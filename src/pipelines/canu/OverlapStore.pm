@@ -61,10 +61,11 @@ use canu::Grid_Cloud;
 #  NOT FILTERING overlaps by error rate when building the parallel store.
 
 
-sub createOverlapStoreSequential ($$$) {
+sub createOverlapStoreSequential ($$$$) {
     my $base    = shift @_;
     my $asm     = shift @_;
     my $tag     = shift @_;
+    my $stream  = shift @_;
     my $bin     = getBinDirectory();
     my $cmd;
 
@@ -92,11 +93,15 @@ sub createOverlapStoreSequential ($$$) {
 
     #  The parallel store build will unlimit 'max user processes'.  The sequential method usually
     #  runs out of open file handles first (meaning it has never run out of processes yet).
+    #
+    #  If streaming (ovsMethod=stream), inputs are read once, sorted runs are spilled when memory
+    #  fills, and the runs are merged directly into the store.  Canu itself only gets one thread.
 
     $cmd  = "$bin/ovStoreBuild \\\n";
     $cmd .= " -O ./$asm.ovlStore.BUILDING \\\n";
     $cmd .= " -G ./$asm.gkpStore \\\n";
     $cmd .= " -M $memSize \\\n";
+    $cmd .= " -stream -t 1 \\\n"  if ($stream);
     $cmd .= " -L ./1-overlapper/ovljob.files \\\n";
     $cmd .= " > ./$asm.ovlStore.err 2>&1";
 
@@ -327,6 +332,7 @@ sub overlapStoreConfigure ($$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M $memLimit \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -O . \\\n";
         print F "  -G ../$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";
@@ -645,8 +651,9 @@ sub createOverlapStore ($$$) {
 
     #  Then just build the store!  Simple!
 
-    createOverlapStoreSequential($base, $asm, $tag)  if ($seq eq "sequential");
-    createOverlapStoreParallel  ($base, $asm, $tag)  if ($seq eq "parallel");
+    createOverlapStoreSequential($base, $asm, $tag, 0)  if ($seq eq "sequential");
+    createOverlapStoreSequential($base, $asm, $tag, 1)  if ($seq eq "stream");
+    createOverlapStoreParallel  ($base, $asm, $tag)     if ($seq eq "parallel");
 
     print STDERR "--\n";
     print STDERR "-- Overlap store '$base/$asm.ovlStore' successfully constructed.\n";